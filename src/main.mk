@@ -15,6 +15,9 @@ SOURCES      := \
                 \
                 bits/fibonacci-v1.C \
                 bits/hexDump-v1.C \
+                bits/murmur-v1.C \
+                bits/rankSelect-v1.C \
+                bits/rans-v1.C \
                 bits/stuffedBits-v1.C \
                 bits/stuffedBits-v1-binary.C \
                 bits/stuffedBits-v1-bits.C \
@@ -22,6 +25,7 @@ SOURCES      := \
                 bits/stuffedBits-v1-gamma.C \
                 bits/stuffedBits-v1-golomb.C \
                 bits/stuffedBits-v1-omega.C \
+                bits/stuffedBits-v1-rans.C \
                 bits/stuffedBits-v1-unary.C \
                 bits/stuffedBits-v1-zeckendorf.C \
                 bits/wordArray-v1.C \
@@ -64,9 +68,11 @@ SOURCES      := \
                 kmers-v1/kmers-writer.C \
                 kmers-v1/kmers.C \
                 \
+                kmers-v2/kmers-counter.C \
                 kmers-v2/kmers-exact.C \
                 kmers-v2/kmers-files.C \
                 kmers-v2/kmers-histogram.C \
+                kmers-v2/kmers-metrics.C \
                 kmers-v2/kmers-reader-dump.C \
                 kmers-v2/kmers-reader.C \
                 kmers-v2/kmers-writer-block.C \
@@ -74,6 +80,7 @@ SOURCES      := \
                 kmers-v2/kmers-writer.C \
                 kmers-v2/kmers.C \
                 \
+                math/crc32c-v1.C \
                 math/md5-v1.C \
                 math/mt19937ar-v1.C \
                 math/sampledDistribution-v1.C \
@@ -208,6 +215,7 @@ SUBMAKEFILES += tests/alignTest-ssw.mk \
                 tests/filesTest.mk \
                 tests/intervalListTest.mk \
                 tests/intervalsTest.mk \
+                tests/kmersTest.mk \
                 tests/count-palindromes.mk \
                 tests/loggingTest.mk \
                 tests/magicNumber.mk \